@@ -46,8 +46,9 @@ typedef struct posix_shm_provider_backend_context_t
 z_alloc_result_t posix_shm_backend_alloc(size_t len, z_allocated_chunk_t *chunk, void *context)
 {
     // this allocator is dummy, only chunk sizes <= POSIX_SHMEM_BUFFER_SIZE are supported!
+    // report it as OUT_OF_MEMORY, so that fragmented allocation retries with smaller chunks
     if (len > POSIX_SHMEM_BUFFER_SIZE)
-        return z_alloc_result_t::OTHER_ERROR;
+        return z_alloc_result_t::OUT_OF_MEMORY;
 
     // find a free chunk
     posix_shm_provider_backend_context_t *c = (posix_shm_provider_backend_context_t *)context;
@@ -90,6 +91,18 @@ void posix_shm_backend_free(z_chunk_descriptor_t *chunk, void *context)
         // critical error?
     }
 }
+// Max chunk size function implementation
+// All our chunks have the same size, so it is either the chunk size or 0 if there is no free chunk
+size_t posix_shm_backend_max_chunk_size(void *context)
+{
+    posix_shm_provider_backend_context_t *c = (posix_shm_provider_backend_context_t *)context;
+    for (size_t i = 0; i < POSIX_SHMEM_BUFFER_COUNT; ++i)
+    {
+        if (!c->chunk_usage[i])
+            return POSIX_SHMEM_BUFFER_SIZE;
+    }
+    return 0;
+}
 void posix_shm_backend_defragment(void *context)
 {
     // nothing to do here
@@ -150,6 +163,7 @@ z_owned_shared_memory_provider_backend_t make_posix_shm_backend()
     // fill the result
     z_owned_shared_memory_provider_backend_t result;
     result.alloc = &posix_shm_backend_alloc;
+    result.max_chunk_size = &posix_shm_backend_max_chunk_size;
     result.defragment = &posix_shm_backend_defragment;
     result.drop = &posix_shm_backend_drop;
     result.free = &posix_shm_backend_free;
@@ -161,6 +175,14 @@ z_owned_shared_memory_provider_backend_t make_posix_shm_backend()
 ///        CLIENT'S CODE        ///
 ///////////////////////////////////
 
+// context for the client side
+typedef struct posix_shm_client_context_t
+{
+    // declare linear segment layout (chunk addresses are computed by Zenoh inline),
+    // or keep the segment opaque (Zenoh calls map/map_batch callbacks)
+    bool linear_layout;
+} posix_shm_client_context_t;
+
 // context for client's segment part
 typedef struct posix_shm_client_segment_context_t
 {
@@ -169,19 +191,38 @@ typedef struct posix_shm_client_segment_context_t
 } posix_shm_client_segment_context_t;
 
 // Maps the chunk id to pointer to exact memory of a segment
-uint8_t *posix_shm_client_segment_context_map(z_chunk_id_t chunk, z_owned_str_t *error, void *context)
+z_client_result_t posix_shm_client_segment_context_map(z_chunk_id_t chunk, uint8_t **data, void *context)
 {
     posix_shm_client_segment_context_t *c = (posix_shm_client_segment_context_t *)context;
 
     // check the arguments for safety
     if (chunk >= POSIX_SHMEM_BUFFER_COUNT)
-    {
-        // error = ...
-        return NULL;
-    }
+        return z_client_result_t::CHUNK_OUT_OF_BOUNDS;
 
     // return the pointer to the chunk data
-    return c->segment->data[chunk];
+    *data = c->segment->data[chunk];
+    return z_client_result_t::CLIENT_OK;
+}
+
+// Maps the array of chunk ids to pointers to exact memory of a segment
+z_client_result_t posix_shm_client_segment_context_map_batch(const z_chunk_id_t *chunks, uint8_t **data, size_t count, void *context)
+{
+    posix_shm_client_segment_context_t *c = (posix_shm_client_segment_context_t *)context;
+
+    z_client_result_t result = z_client_result_t::CLIENT_OK;
+    for (size_t i = 0; i < count; ++i)
+    {
+        // check the arguments for safety, but keep mapping the rest of the batch
+        if (chunks[i] >= POSIX_SHMEM_BUFFER_COUNT)
+        {
+            data[i] = NULL;
+            if (result == z_client_result_t::CLIENT_OK)
+                result = z_client_result_t::CHUNK_OUT_OF_BOUNDS;
+            continue;
+        }
+        data[i] = c->segment->data[chunks[i]];
+    }
+    return result;
 }
 
 void posix_shm_client_segment_context_drop(void *context)
@@ -198,11 +239,8 @@ void posix_shm_client_segment_context_drop(void *context)
 // Attach to a new segment
 // This code mmaps to particular named shared memory segment identified by it's segment id
 // and initializes a segment context that is used for mappings within this segment (see posix_shm_client_segment_context_map)
-z_owned_str_t posix_shm_client_attach(z_segment_id_t id, z_owned_shared_memory_segment_t *segment, void *context)
+z_client_result_t posix_shm_client_attach(z_segment_id_t id, z_owned_shared_memory_segment_t *segment, void *context)
 {
-    // allocate memory for the segment context
-    posix_shm_client_segment_context_t *segment_context = (posix_shm_client_segment_context_t *)calloc(1, sizeof(*segment_context));
-
     // make filename from segment identifier
     char filename[64];
     sprintf(filename, "%u", id);
@@ -210,40 +248,78 @@ z_owned_str_t posix_shm_client_attach(z_segment_id_t id, z_owned_shared_memory_s
     // open named POSIX shared memory segment
     int fd = shm_open(filename, O_RDWR, 0777);
     if (fd == -1)
-        exit(-1);
+        return z_client_result_t::SEGMENT_NOT_FOUND;
 
     // attach to the segment
-    segment_context->segment = (posix_shm_segment_t *)mmap(NULL, sizeof(posix_shm_segment_t), PROT_READ | PROT_WRITE,
-                                                           MAP_SHARED, fd, 0);
-    if (segment_context->segment == NULL)
-        exit(-1);
+    posix_shm_segment_t *shm = (posix_shm_segment_t *)mmap(NULL, sizeof(posix_shm_segment_t), PROT_READ | PROT_WRITE,
+                                                          MAP_SHARED, fd, 0);
 
     // close FD
     // "After the mmap() call has returned, the file descriptor, fd, can
     // be closed immediately without invalidating the mapping."
     close(fd);
 
+    if (shm == MAP_FAILED)
+        return z_client_result_t::SEGMENT_MAP_FAILED;
+
+    // allocate memory for the segment context
+    posix_shm_client_segment_context_t *segment_context = (posix_shm_client_segment_context_t *)calloc(1, sizeof(*segment_context));
+    segment_context->segment = shm;
+
     // fill the result
     segment->context = segment_context;
     segment->drop = &posix_shm_client_segment_context_drop;
-    segment->map = &posix_shm_client_segment_context_map;
 
-    // return "no error"
-    z_owned_str_t err;
-    memset(&err, 0, sizeof(err));
-    return err;
+    posix_shm_client_context_t *c = (posix_shm_client_context_t *)context;
+    if (c->linear_layout)
+    {
+        // our chunk ids are chunk indexes within a flat array, so we can declare linear layout and
+        // let Zenoh compute chunk addresses inline: map and map_batch are never called then
+        segment->layout.kind = z_segment_layout_kind_t::LAYOUT_STRIDE;
+        segment->layout.base = (uint8_t *)shm->data;
+        segment->layout.size = sizeof(shm->data);
+        segment->layout.unit = POSIX_SHMEM_BUFFER_SIZE;
+    }
+    else
+    {
+        // opaque segment (layout is left zero-initialized): Zenoh resolves chunks with our callbacks,
+        // bursts of samples are resolved with a single map_batch call
+        segment->map = &posix_shm_client_segment_context_map;
+        segment->map_batch = &posix_shm_client_segment_context_map_batch;
+    }
+
+    // no error - nothing to fill or allocate
+    return z_client_result_t::CLIENT_OK;
 }
+
+// Describes the error in details (called only if somebody asks for the error message)
+size_t posix_shm_client_describe(z_client_result_t result, z_segment_id_t segment, char *buf, size_t len, void *context)
+{
+    int written = snprintf(buf, len, "posix shm segment %u: %s", segment, z_client_result_str(result));
+    if (written < 0 || len == 0)
+        return 0;
+
+    // snprintf returns the untruncated length, but we must report what actually fits into buf
+    return (size_t)written < len - 1 ? (size_t)written : len - 1;
+}
+
 void posix_shm_client_drop(void *context)
 {
-    // do nothing here
+    // delete the context
+    free(context);
 }
 
-z_owned_shared_memory_client_t make_posix_shm_client()
+z_owned_shared_memory_client_t make_posix_shm_client(bool linear_layout)
 {
+    // allocate memory for the context
+    posix_shm_client_context_t *context = (posix_shm_client_context_t *)calloc(1, sizeof(*context));
+    context->linear_layout = linear_layout;
+
     // fill the result
     z_owned_shared_memory_client_t result;
-    result.context = NULL;
+    result.context = context;
     result.attach = &posix_shm_client_attach;
+    result.describe = &posix_shm_client_describe;
     result.drop = &posix_shm_client_drop;
     return result;
 }
@@ -259,7 +335,8 @@ void use_posix_shm()
     // create map with shared memory protocol clients
     z_shared_memory_mapped_clients_t clients[1];
     clients[0].id = 0;
-    clients[0].client = make_posix_shm_client();
+    // our chunks are fixed-size array elements, so the linear layout is the natural choice here
+    clients[0].client = make_posix_shm_client(true);
 
     z_owned_str_t error;
 
@@ -268,3 +345,24 @@ void use_posix_shm()
 
     // .....
 }
+
+// The same client with opaque segments
+// Opaque segments are needed when chunk addresses cannot be computed from chunk ids (e.g. the segment is
+// mapped lazily, or chunk ids are keys in the provider's index table): Zenoh calls map for single samples
+// and map_batch for bursts of samples then
+void use_posix_shm_opaque()
+{
+    z_shared_memory_mapped_providers_t providers[1];
+    providers[0].id = 0;
+    providers[0].backend = make_posix_shm_backend();
+
+    z_shared_memory_mapped_clients_t clients[1];
+    clients[0].id = 0;
+    clients[0].client = make_posix_shm_client(false);
+
+    z_owned_str_t error;
+
+    z_owned_shared_memory_factory_t shmf = z_shared_memory_factory_make(providers, 1, clients, 1, &error);
+
+    // .....
+}
@@ -0,0 +1,65 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../zenoh_shm.h"
+
+// The example on how to publish buffers that are held as file descriptors (memfd, dma-buf, etc)
+// Here memfd stands for the buffer produced by some device or another process
+void fd_import_usage_example(z_owned_session_t *s, z_owned_publisher_t *pub)
+{
+    const size_t frame_size = 4096;
+
+    // create the buffer and fill it (this is what the device or decoder normally does)
+    int fd = memfd_create("frame", MFD_CLOEXEC);
+    if (fd == -1 || ftruncate(fd, frame_size) == -1)
+    {
+        printf("Unable to create memfd!\n");
+        exit(-1);
+    }
+    uint8_t *frame = (uint8_t *)mmap(NULL, frame_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (frame == MAP_FAILED)
+    {
+        printf("Unable to map memfd!\n");
+        exit(-1);
+    }
+    snprintf((char *)frame, frame_size, "frame from memfd");
+    munmap(frame, frame_size);
+
+    // register the fd once: it gets it's own segment, which subscribers attach to once
+    z_client_result_t result;
+    z_owned_shared_memory_fd_t registered = z_shared_memory_register_fd(z_loan(*s), fd, &result);
+
+    // zenoh keeps it's own duplicate of fd
+    close(fd);
+
+    if (!z_shared_memory_fd_check(&registered))
+    {
+        printf("Unable to register fd: %s\n", z_client_result_str(result));
+        exit(-1);
+    }
+
+    // devices re-queue the same buffers every frame, so each frame is just a cheap import of the region
+    for (int i = 0; i < 3; ++i)
+    {
+        zc_owned_shmbuf_t shmbuf = z_shared_memory_import_fd(&registered, 0, frame_size, NULL, NULL, &result);
+        if (result != z_client_result_t::CLIENT_OK)
+        {
+            printf("Unable to import fd: %s\n", z_client_result_str(result));
+            break;
+        }
+
+        // publish the shared memory buffer: subscribers will map the same pages
+        z_publisher_put_options_t options = z_publisher_put_options_default();
+        options.encoding = z_encoding(Z_ENCODING_PREFIX_TEXT_PLAIN, NULL);
+        zc_owned_payload_t payload = zc_shmbuf_into_payload(z_move(shmbuf));
+        zc_publisher_put_owned(z_loan(*pub), z_move(payload), &options);
+    }
+
+    // the segment is released once all published frames are released
+    z_shared_memory_fd_drop(&registered);
+}
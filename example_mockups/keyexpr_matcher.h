@@ -0,0 +1,50 @@
+#include <stdio.h>
+
+#include "../zenoh_keyexpr.h"
+
+// The example on how to route a sample to many subscriptions at once
+void keyexpr_matcher_usage_example(const z_sample_t *sample)
+{
+    // compile subscriptions
+    zc_owned_keyexpr_matcher_t matcher = zc_keyexpr_matcher_new();
+    zc_keyexpr_matcher_insert(&matcher, z_keyexpr("robot/*/joints"), 1);
+    zc_keyexpr_matcher_insert(&matcher, z_keyexpr("robot/**"), 2);
+    zc_keyexpr_matcher_insert(&matcher, z_keyexpr("camera/**"), 3);
+
+    // find all subscriptions matching the sample
+    uint64_t ids[64];
+    size_t count = zc_keyexpr_matcher_match(&matcher, sample->keyexpr, ids, 64);
+    for (size_t i = 0; i < count && i < 64; ++i)
+    {
+        printf("subscription %llu matches\n", (unsigned long long)ids[i]);
+    }
+
+    // subscription is gone
+    zc_keyexpr_matcher_remove(&matcher, 2);
+
+    zc_keyexpr_matcher_drop(&matcher);
+}
+
+// The example on how to enable the key expression cache, once, right after the session is opened
+bool keyexpr_cache_setup_example(z_owned_session_t *s)
+{
+    if (zc_session_keyexpr_cache_enable(z_loan(*s), NULL) != 0)
+    {
+        // key expressions will not be interned, zc_keyexpr_intern returns them as is
+        printf("Unable to enable key expression cache!\n");
+        return false;
+    }
+    return true;
+}
+
+// The example on how to publish on key expressions built on the fly without per-put string encoding
+// The cache is expected to be enabled by keyexpr_cache_setup_example
+void keyexpr_cache_usage_example(z_owned_session_t *s, const char *robot, const uint8_t *data, size_t len)
+{
+    // build the key expression and intern it, hot key expressions get numeric wire ids
+    z_owned_keyexpr_t joined = z_keyexpr_join(z_keyexpr("robot"), z_keyexpr(robot));
+    z_owned_keyexpr_t keyexpr = zc_keyexpr_intern(z_loan(*s), z_move(joined));
+
+    z_put(z_loan(*s), z_loan(keyexpr), data, len, NULL);
+    z_drop(z_move(keyexpr));
+}
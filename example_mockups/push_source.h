@@ -1,7 +1,11 @@
+#include <stdio.h>
+#include <stdlib.h>
+
 #include "../zenoh_shm.h"
 
 // The example on how to work with push sources!
 // This is a callback for push source, it is called by some external code (eg. device library, timer - whatever)
+// It may be called concurrently from several threads of the external code
 void push_source_callback(
     z_owned_publisher_t *pub,
     z_shared_memory_provider_t provider,
@@ -28,3 +32,51 @@ void push_source_callback(
         // handle error
     }
 }
+
+// The example on how to work with push sources that can fill provider-owned memory
+// The ring of slots is created once, so frames are published by slot index with no per-frame mapping
+z_owned_shared_memory_ring_t make_push_source_ring(z_shared_memory_provider_t provider, size_t frame_size)
+{
+    z_alloc_result_t result;
+    // frames are delivered from several DMA completion threads, keep them in capture order
+    z_shared_memory_ring_options_t options = z_shared_memory_ring_options_default();
+    options.mode = z_ring_publication_mode_t::RING_ORDERED;
+    // a stuck DMA thread must not stall the whole stream: skip it's frame after 100ms
+    options.ordered_timeout_ms = 100;
+
+    z_owned_shared_memory_ring_t ring = z_shared_memory_ring_new(provider, 8, frame_size, &options, &result);
+    if (!z_shared_memory_ring_check(&ring))
+    {
+        printf("Unable to create the ring: %d!\n", result);
+        exit(-1);
+    }
+
+    // register slot addresses in device library here, if needed (see z_shared_memory_ring_slot_ptr)
+    return ring;
+}
+
+// This is called by device threads for each frame, concurrently
+void push_source_ring_callback(z_owned_publisher_t *pub, z_owned_shared_memory_ring_t ring)
+{
+    size_t index;
+    if (z_shared_memory_ring_acquire(ring, &index) == z_ring_result_t::RING_FULL)
+    {
+        // subscribers haven't released the frames yet - drop this frame (or wait)
+        return;
+    }
+
+    // fill the slot with frame data
+    uint8_t *frame = z_shared_memory_ring_slot_ptr(ring, index);
+    size_t len = ... // device fills the frame
+    if (len == 0)
+    {
+        // the device failed to deliver the frame - give the slot back, otherwise it is lost for good
+        z_shared_memory_ring_release(ring, index);
+        return;
+    }
+
+    // publish the slot
+    z_publisher_put_options_t options = z_publisher_put_options_default();
+    options.encoding = z_encoding(Z_ENCODING_PREFIX_APP_OCTET_STREAM, NULL);
+    z_shared_memory_ring_publish(z_loan(*pub), ring, index, len, &options);
+}
@@ -50,14 +50,17 @@ void publisher_usage_example(z_owned_config_t *config, z_owned_keyexpr_t *keyexp
         exit(-1);
     }
 
-    // get shared memory provider handle from session
-    z_shared_memory_provider_t provider = z_session_shared_memory_provider(s, 0);
-    if (!z_check(provider))
+    // resolve shared memory provider once and bind it to the publisher
+    // the default options let Zenoh calibrate SHM-vs-inline threshold for plain z_publisher_put calls
+    if (z_publisher_bind_shared_memory_provider(z_loan(pub), 0, NULL) < 0)
     {
-        printf("Unable to get provider from session!\n");
+        printf("Unable to bind provider to publisher!\n");
         exit(-1);
     }
 
+    // get cached shared memory provider handle from publisher (no lookup by protocol id)
+    z_shared_memory_provider_t provider = z_publisher_shared_memory_provider(z_loan(pub));
+
     zc_owned_shmbuf_t shmbuf;
     for (int idx = 0; true; ++idx)
     {
@@ -108,3 +111,124 @@ void publisher_usage_example(z_owned_config_t *config, z_owned_keyexpr_t *keyexp
     z_undeclare_publisher(z_move(pub));
     z_close(z_move(s));
 }
+
+// the example on how to publish with automatic SHM-vs-inline selection
+// the publisher must have shared memory provider bound (see publisher_usage_example)
+void publisher_threshold_usage_example(z_publisher_t pub, const uint8_t *frame, size_t frame_len)
+{
+    // payloads above the publisher's threshold are placed into SHM by Zenoh, smaller ones are sent inline
+    printf("SHM threshold is %zu bytes\n", z_publisher_shared_memory_threshold(pub));
+
+    z_publisher_put_options_t options = z_publisher_put_options_default();
+    options.encoding = z_encoding(Z_ENCODING_PREFIX_APP_OCTET_STREAM, NULL);
+    z_publisher_put(pub, frame, frame_len, &options);
+}
+
+// the example on how to publish many small SHM samples at once (e.g. each control cycle)
+#define CONTROL_CYCLE_SAMPLES 500
+void publisher_batch_usage_example(z_publisher_t pub, z_shared_memory_provider_t provider)
+{
+    zc_owned_payload_t payloads[CONTROL_CYCLE_SAMPLES];
+    size_t count = 0;
+    for (size_t i = 0; i < CONTROL_CYCLE_SAMPLES; ++i)
+    {
+        zc_owned_shmbuf_t shmbuf;
+        if (z_shared_memory_provider_alloc(provider, 64, &shmbuf) != z_alloc_result_t::OK)
+            break;
+
+        snprintf((char *)zc_shmbuf_ptr(&shmbuf), 64, "[%4zu] sample", i);
+        zc_shmbuf_set_length(&shmbuf, strlen((char *)zc_shmbuf_ptr(&shmbuf)));
+        payloads[count++] = zc_shmbuf_into_payload(z_move(shmbuf));
+    }
+
+    // publish all the samples as one batched message with default options
+    zc_publisher_put_owned_batch(pub, payloads, NULL, count);
+}
+
+// the example on how to publish with zero allocator calls in steady state
+// the publisher must have shared memory provider bound (see publisher_usage_example)
+void publisher_pool_usage_example(z_publisher_t pub)
+{
+    // allocate all the buffers once
+    if (z_publisher_shared_memory_pool_init(pub, 16, 1024) != z_alloc_result_t::OK)
+    {
+        printf("Unable to create the pool!\n");
+        exit(-1);
+    }
+
+    zc_owned_shmbuf_t shmbuf;
+    for (int idx = 0; true; ++idx)
+    {
+        // loan the buffer from the pool, it comes back once all subscribers release it
+        if (z_publisher_shared_memory_loan(pub, &shmbuf) != z_alloc_result_t::OK)
+        {
+            // all the buffers are in flight, subscribers are too slow
+            sleep(1);
+            continue;
+        }
+
+        // obtain data pointer
+        char *buf = (char *)zc_shmbuf_ptr(&shmbuf);
+        snprintf(buf, 255, "[%4d] %s", idx, value);
+        zc_shmbuf_set_length(&shmbuf, strlen(buf));
+
+        // publish the shared memory buffer
+        z_publisher_put_options_t options = z_publisher_put_options_default();
+        options.encoding = z_encoding(Z_ENCODING_PREFIX_TEXT_PLAIN, NULL);
+        zc_owned_payload_t payload = zc_shmbuf_into_payload(z_move(shmbuf));
+        zc_publisher_put_owned(pub, z_move(payload), &options);
+
+        sleep(1);
+    }
+}
+
+// the example on how to publish a message made of a small header and a large body from another provider
+void publisher_scatter_gather_usage_example(z_publisher_t pub, z_shared_memory_provider_t provider, zc_owned_shmbuf_t *camera_frame)
+{
+    zc_owned_shmbuf_t bufs[2];
+
+    // allocate and fill the header
+    if (z_shared_memory_provider_alloc(provider, 64, &bufs[0]) != z_alloc_result_t::OK)
+    {
+        zc_shmbuf_drop(camera_frame);
+        return;
+    }
+    snprintf((char *)zc_shmbuf_ptr(&bufs[0]), 64, "frame %zu bytes", zc_shmbuf_length(camera_frame));
+    zc_shmbuf_set_length(&bufs[0], strlen((char *)zc_shmbuf_ptr(&bufs[0])));
+
+    // the body is the camera frame as is
+    bufs[1] = *camera_frame;
+    *camera_frame = zc_shmbuf_null();
+
+    // publish header and body as one payload, no coalescing copy is made
+    z_publisher_put_options_t options = z_publisher_put_options_default();
+    zc_owned_payload_t payload = zc_shmbufs_into_payload(bufs, 2);
+    zc_publisher_put_owned(pub, z_move(payload), &options);
+}
+
+// the example on how to publish a payload bigger than the largest free chunk of the provider
+#define MAX_FRAGMENTS 16
+void publisher_fragmented_usage_example(z_publisher_t pub, z_shared_memory_provider_t provider, const uint8_t *data, size_t len)
+{
+    zc_owned_shmbuf_t fragments[MAX_FRAGMENTS];
+    size_t count;
+    if (z_shared_memory_provider_alloc_fragmented(provider, len, fragments, MAX_FRAGMENTS, &count) != z_alloc_result_t::OK)
+    {
+        printf("Unable to allocate %zu bytes\n", len);
+        return;
+    }
+
+    // fill the fragments
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t fragment_len = zc_shmbuf_length(&fragments[i]);
+        memcpy(zc_shmbuf_ptr(&fragments[i]), data + offset, fragment_len);
+        offset += fragment_len;
+    }
+
+    // publish all the fragments as one payload, subscribers get the segmented view
+    z_publisher_put_options_t options = z_publisher_put_options_default();
+    zc_owned_payload_t payload = zc_shmbufs_into_payload(fragments, count);
+    zc_publisher_put_owned(pub, z_move(payload), &options);
+}
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <sys/epoll.h>
 #include <unistd.h>
 
 #include "../zenoh_shm.h"
@@ -28,6 +29,21 @@ void data_handler(const z_sample_t *sample, void *arg) {
     z_drop(z_move(keystr));
 }
 
+// the handler for subscribers accepting segmented payloads (see zc_closure_sample_segmented)
+void segmented_data_handler(const z_sample_t *sample, void *arg) {
+    z_owned_str_t keystr = z_keyexpr_to_string(sample->keyexpr);
+    printf(">> [Subscriber] Received %s ('%s': '", kind_to_str(sample->kind), z_loan(keystr));
+    // the payload may consist of several SHM slices (see zc_shmbufs_into_payload)
+    // zc_sample_payload_linearize can be used if contiguous memory is needed
+    z_payload_slice_iterator_t iter = z_sample_payload_slices_iter(sample);
+    z_bytes_t slice;
+    while (z_payload_slice_iterator_next(&iter, &slice)) {
+        printf("%.*s", (int)slice.len, slice.start);
+    }
+    printf("')\n");
+    z_drop(z_move(keystr));
+}
+
 // the simple example on how to use SHM provider API
 void subscriber_usage_example(z_owned_config_t *config, z_owned_keyexpr_t *keyexpr)
 {
@@ -84,3 +100,178 @@ void subscriber_usage_example(z_owned_config_t *config, z_owned_keyexpr_t *keyex
     z_undeclare_subscriber(z_move(sub));
     z_close(z_move(s));
 }
+
+// prints the owned sample (e.g. received from a channel), it's payload may consist of several slices
+void print_owned_sample(const zc_owned_sample_t *sample) {
+    printf(">> [Subscriber] Received '");
+    z_payload_slice_iterator_t iter = zc_payload_slices_iter(&sample->payload);
+    z_bytes_t slice;
+    while (z_payload_slice_iterator_next(&iter, &slice)) {
+        printf("%.*s", (int)slice.len, slice.start);
+    }
+    printf("'\n");
+}
+
+// the example on how to receive multi-slice payloads without coalescing copy
+void subscriber_segmented_usage_example(z_owned_session_t *s, z_owned_keyexpr_t *keyexpr)
+{
+    // opt in to segmented payloads
+    z_owned_closure_sample_t handler = z_closure(segmented_data_handler);
+    z_owned_closure_sample_t callback = zc_closure_sample_segmented(z_move(handler));
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(*s), z_move(keyexpr), z_move(callback), NULL);
+    if (!z_check(sub)) {
+        printf("Unable to declare subscriber.\n");
+        exit(-1);
+    }
+
+    // ....
+
+    z_undeclare_subscriber(z_move(sub));
+}
+
+// the example on how to process samples on own thread without stalling zenoh's ones
+void subscriber_channel_usage_example(z_owned_session_t *s, z_owned_keyexpr_t *keyexpr)
+{
+    // create the channel, slow processing drops the oldest samples and releases their SHM buffers
+    zc_sample_channel_options_t options = zc_sample_channel_options_default();
+    options.bound = 64;
+    options.overflow = zc_channel_overflow_t::CHANNEL_DROP_OLDEST;
+    options.segmented = true;
+    zc_owned_sample_channel_t channel = zc_sample_channel_new(&options);
+
+    // declare subscriber with the send end of the channel
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(*s), z_move(keyexpr), z_move(channel.send), NULL);
+    if (!z_check(sub)) {
+        printf("Unable to declare subscriber.\n");
+        exit(-1);
+    }
+
+    // process samples in bursts
+    zc_owned_sample_t samples[16];
+    zc_owned_sample_t sample;
+    while (zc_sample_receiver_recv(&channel.recv, &sample) == zc_recv_result_t::RECV_OK) {
+        samples[0] = sample;
+        size_t count = 1 + zc_sample_receiver_recv_batch(&channel.recv, samples + 1, 15);
+        for (size_t i = 0; i < count; ++i) {
+            print_owned_sample(&samples[i]);
+            zc_sample_drop(&samples[i]);
+        }
+    }
+
+    z_undeclare_subscriber(z_move(sub));
+    zc_sample_receiver_drop(&channel.recv);
+}
+
+// the example on how to process pulled data in batches
+void pull_subscriber_batch_usage_example(z_owned_pull_subscriber_t *sub)
+{
+    zc_owned_sample_t samples[64];
+    size_t pending;
+    do {
+        // the first call pulls from the router (waiting up to 100ms for the reply),
+        // the next ones only drain what didn't fit into the array
+        size_t count;
+        pending = zc_subscriber_pull_batch(z_loan(*sub), samples, 64, 100, &count);
+        for (size_t i = 0; i < count; ++i) {
+            print_owned_sample(&samples[i]);
+            zc_sample_drop(&samples[i]);
+        }
+    } while (pending > 0);
+}
+
+// the example on how to run slow callbacks on worker pool
+void subscriber_executor_usage_example(z_owned_session_t *s, z_owned_keyexpr_t *keyexpr)
+{
+    // create the executor with a worker per core
+    zc_owned_executor_t executor = zc_executor_new(NULL);
+
+    // data_handler is called on executor's workers, in order for each key expression
+    z_owned_closure_sample_t handler = z_closure(data_handler);
+    z_owned_closure_sample_t callback = zc_executor_closure_sample(&executor, z_move(handler), zc_executor_ordering_t::ORDER_PER_KEYEXPR);
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(*s), z_move(keyexpr), z_move(callback), NULL);
+    if (!z_check(sub)) {
+        printf("Unable to declare subscriber.\n");
+        exit(-1);
+    }
+
+    // ....
+
+    z_undeclare_subscriber(z_move(sub));
+    zc_executor_drop(&executor);
+}
+
+// the example on how to receive samples in an external epoll loop
+void subscriber_epoll_usage_example(z_owned_session_t *s, z_owned_keyexpr_t *keyexpr)
+{
+    // create pollable channel
+    zc_sample_channel_options_t options = zc_sample_channel_options_default();
+    options.pollable = true;
+    zc_owned_sample_channel_t channel = zc_sample_channel_new(&options);
+
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(*s), z_move(keyexpr), z_move(channel.send), NULL);
+    if (!z_check(sub)) {
+        printf("Unable to declare subscriber.\n");
+        exit(-1);
+    }
+
+    // register the receiver's fd in the event loop along with other service fds
+    int epfd = epoll_create1(0);
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = zc_sample_receiver_fd(&channel.recv);
+    epoll_ctl(epfd, EPOLL_CTL_ADD, ev.data.fd, &ev);
+
+    struct epoll_event events[8];
+    while (true) {
+        int n = epoll_wait(epfd, events, 8, -1);
+        for (int i = 0; i < n; ++i) {
+            if (events[i].data.fd != zc_sample_receiver_fd(&channel.recv))
+                continue; // other service fds
+
+            // drain the whole burst
+            zc_owned_sample_t samples[16];
+            size_t count;
+            while ((count = zc_sample_receiver_recv_batch(&channel.recv, samples, 16)) > 0) {
+                for (size_t j = 0; j < count; ++j) {
+                    print_owned_sample(&samples[j]);
+                    zc_sample_drop(&samples[j]);
+                }
+            }
+        }
+    }
+
+    close(epfd);
+    z_undeclare_subscriber(z_move(sub));
+    zc_sample_receiver_drop(&channel.recv);
+}
+
+// the example on how to receive only the newest camera frames (e.g. for display)
+void subscriber_latest_frame_usage_example(z_owned_session_t *s, z_owned_keyexpr_t *keyexpr)
+{
+    // keep only the newest frame for each of up to 4 cameras, stale frames are released right away
+    // (so at most 4 queued frames plus the one being rendered hold SHM buffers)
+    zc_sample_channel_options_t options = zc_sample_channel_options_default();
+    options.bound = 4;
+    options.overflow = zc_channel_overflow_t::CHANNEL_CONFLATE;
+    zc_owned_sample_channel_t channel = zc_sample_channel_new(&options);
+
+    z_owned_subscriber_t sub = z_declare_subscriber(z_loan(*s), z_move(keyexpr), z_move(channel.send), NULL);
+    if (!z_check(sub)) {
+        printf("Unable to declare subscriber.\n");
+        exit(-1);
+    }
+
+    zc_owned_sample_t frame;
+    while (zc_sample_receiver_recv(&channel.recv, &frame) == zc_recv_result_t::RECV_OK) {
+        // the renderer needs the frame in contiguous memory (no copy if it is contiguous already)
+        zc_owned_payload_t pixels = zc_payload_linearize(&frame.payload);
+
+        // render the frame, no matter how slow it is, and release it before receiving the next one
+        sleep(1);
+        zc_payload_drop(&pixels);
+        zc_sample_drop(&frame);
+    }
+
+    z_undeclare_subscriber(z_move(sub));
+    zc_sample_receiver_drop(&channel.recv);
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../zenoh_shm.h"
+
+// The example on how to share high-rate state without per-update allocations and messages
+
+typedef struct joint_state_t
+{
+    double position[6];
+    double velocity[6];
+} joint_state_t;
+
+// state publisher side: the state is overwritten in place
+void state_publisher_usage_example(z_owned_session_t *s, z_shared_memory_provider_t provider)
+{
+    z_owned_state_publisher_t pub = z_declare_state_publisher(z_loan(*s), z_keyexpr("robot/joints"), provider, sizeof(joint_state_t), NULL);
+    if (!z_state_publisher_check(&pub))
+    {
+        printf("Unable to declare state publisher!\n");
+        exit(-1);
+    }
+
+    joint_state_t state;
+    memset(&state, 0, sizeof(state));
+    while (true)
+    {
+        // read the joints here...
+        z_state_publisher_write(&pub, (const uint8_t *)&state, sizeof(state));
+        usleep(1000);
+    }
+
+    z_undeclare_state_publisher(&pub);
+}
+
+// state subscriber side: the latest snapshot is read whenever needed
+void state_subscriber_usage_example(z_owned_session_t *s)
+{
+    // no change notifications needed, the control loop polls the state
+    z_owned_state_subscriber_t sub = z_declare_state_subscriber(z_loan(*s), z_keyexpr("robot/joints"), NULL, NULL);
+
+    joint_state_t state;
+    size_t len;
+    uint64_t version;
+    while (true)
+    {
+        z_state_result_t res = z_state_subscriber_read(&sub, (uint8_t *)&state, sizeof(state), &len, &version);
+        if (res == z_state_result_t::STATE_OK)
+        {
+            printf("[%llu] joint 0 at %f\n", (unsigned long long)version, state.position[0]);
+        }
+        else if (res == z_state_result_t::STATE_BUSY)
+        {
+            // no consistent snapshot: keep using the previous state and try again on the next cycle
+            printf("state is busy\n");
+        }
+        usleep(10000);
+    }
+
+    z_undeclare_state_subscriber(&sub);
+}
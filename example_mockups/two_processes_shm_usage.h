@@ -34,12 +34,39 @@ void process1()
         exit(-1);
     }
 
+    // deliver camera frames to subscribers on the same host without going through the transport
+    z_session_shared_memory_enable_local_delivery(z_loan(s), NULL);
+
+    // subscribers without qualcomm client will receive camera frames copied by value, we can check who they are
+    z_id_t peers[16];
+    size_t peer_count = 0;
+    z_owned_closure_zid_t collect = ... // collects peer ids into peers array and counts them in peer_count
+    z_info_peers_zid(z_loan(s), z_move(collect));
+    for (size_t i = 0; i < peer_count; ++i)
+    {
+        if (!z_session_shared_memory_peer_supports(z_loan(s), &peers[i], 1))
+        {
+            printf("Peer %zu will receive copies of camera frames\n", i);
+        }
+    }
+
     // publish camera frames.... (like in simple_shm_publisher.h)
+
+    // ....or, if renderers only need the latest frame, use triple buffer that never blocks the camera
+    z_shared_memory_provider_t provider = z_session_shared_memory_provider(s, 1);
+    z_owned_triple_buffer_writer_t writer = z_declare_triple_buffer_writer(z_loan(s), z_keyexpr("camera/0"), provider, 1920 * 1080 * 4, NULL);
+    while (true)
+    {
+        uint8_t *frame = z_triple_buffer_writer_frame(&writer);
+        // ....capture into frame
+        z_triple_buffer_writer_publish(&writer, 1920 * 1080 * 4);
+    }
 }
 
 
 /// PROCESS 2 ///
 z_owned_shared_memory_client_t qualcomm_client() { ... }
+z_owned_shared_memory_client_t sony_client() { ... }
 void process2()
 {
     // Create the SHM Factory for camera subscriber
@@ -67,5 +94,33 @@ void process2()
         exit(-1);
     }
 
+    // receive camera frames from the same host publisher with low latency: spin a bit before parking
+    z_shm_local_delivery_options_t local_options = z_shm_local_delivery_options_default();
+    local_options.spin_iterations = 10000;
+    z_session_shared_memory_enable_local_delivery(z_loan(s), &local_options);
+
     // subscribe to camera frames.... (like in simple_shm_subscriber.h)
+
+    // ....or render the latest camera frame from triple buffer
+    z_owned_triple_buffer_reader_t reader = z_declare_triple_buffer_reader(z_loan(s), z_keyexpr("camera/0"));
+    z_bytes_t frame;
+    if (z_triple_buffer_reader_acquire(&reader, &frame, NULL))
+    {
+        // ....render frame
+    }
+
+    // a new camera with it's own shm protocol is connected at runtime: register the client
+    // on the running session without tearing it down and losing the declarations
+    z_shared_memory_mapped_clients_t camera;
+    camera.id = 2;
+    camera.client = sony_client();
+    if (z_session_shared_memory_add_client(z_loan(s), &camera) < 0)
+    {
+        printf("Unable to add shared memory client!\n");
+    }
+
+    // ....
+
+    // the camera is disconnected: unregister it's client. Samples already received from it stay valid
+    z_session_shared_memory_remove_client(z_loan(s), 2);
 }
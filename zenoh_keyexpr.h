@@ -0,0 +1,105 @@
+#include <stdint.h>
+
+#include "zenoh_c_api/zenoh.h"
+
+//// KEY EXPRESSIONS ////
+
+// Instruction set used by key expression kernels enum
+// z_keyexpr_canonize, z_keyexpr_is_canon and zc_keyexpr_from_slice validate chunk separators, find `*`/`$*` runs
+// and detect non-canonical forms 16 or 32 bytes at a time. The best supported kernel is selected once, by CPUID,
+// and the scalar kernel is used on other CPUs. All kernels give identical results
+enum zc_keyexpr_kernel_t
+{
+    KEYEXPR_KERNEL_SCALAR = 0,
+    KEYEXPR_KERNEL_SSE42 = 1,
+    KEYEXPR_KERNEL_AVX2 = 2
+};
+
+/// Get the key expression kernel in use
+ZENOHC_API zc_keyexpr_kernel_t zc_keyexpr_kernel(void);
+
+/// Force the key expression kernel (e.g. to compare it against the scalar one in the same process)
+/// Can be called at any time: the kernel dispatch pointer is swapped atomically, and as all kernels give identical
+/// results, key expressions constructed with the previous kernel stay valid. Calls already running finish
+/// with the previous kernel
+/// @param kernel the kernel to use
+/// @returns 0 in case of success, negative value if the kernel is not supported by the CPU
+ZENOHC_API int8_t zc_keyexpr_set_kernel(zc_keyexpr_kernel_t kernel);
+
+// Compiled set of key expressions
+// The key expressions are split into chunks and compiled into a trie with dedicated `*` and `**` edges,
+// so the chunks shared by several key expressions are compared once instead of once per z_keyexpr_intersects call.
+// Matching a key without wildcards against patterns without `**` walks a single path per chunk; `**` edges and
+// wildcards in the key make several branches match at once, so in the worst case the cost approaches checking
+// every compiled key expression
+typedef struct zc_owned_keyexpr_matcher_t
+{
+    void *_0;
+} zc_owned_keyexpr_matcher_t;
+
+/// Create an empty matcher
+ZENOHC_API zc_owned_keyexpr_matcher_t zc_keyexpr_matcher_new(void);
+
+/// Insert key expression into the matcher
+/// Several key expressions may have the same id, and the same key expression may be inserted with different ids
+/// @param matcher the matcher
+/// @param keyexpr the key expression, may contain `*` and `**` wildcards
+/// @param id the subscription id to report on match
+/// @returns 0 in case of success, negative value if keyexpr is not valid
+ZENOHC_API int8_t zc_keyexpr_matcher_insert(zc_owned_keyexpr_matcher_t *matcher, z_keyexpr_t keyexpr, uint64_t id);
+
+/// Remove all key expressions inserted with the id
+/// @param matcher the matcher
+/// @param id the subscription id
+/// @returns the number of removed key expressions
+ZENOHC_API size_t zc_keyexpr_matcher_remove(zc_owned_keyexpr_matcher_t *matcher, uint64_t id);
+
+/// Get ids of all key expressions intersecting with the key (see z_keyexpr_intersects)
+/// Concurrent calls are safe, but insert and remove must not be called concurrently with any other call
+/// @param matcher the matcher
+/// @param key the key expression to match
+/// @param ids array to be filled with matching ids (each id is reported once), can be NULL
+/// @param capacity number of elements in ids
+/// @returns the total number of matching ids (can be greater than capacity)
+ZENOHC_API size_t zc_keyexpr_matcher_match(
+    const zc_owned_keyexpr_matcher_t *matcher,
+    z_keyexpr_t key,
+    uint64_t *ids,
+    size_t capacity);
+
+/// Returns `false` if `matcher` is the gravestone value
+ZENOHC_API bool zc_keyexpr_matcher_check(const zc_owned_keyexpr_matcher_t *matcher);
+
+/// Drops the matcher
+ZENOHC_API void zc_keyexpr_matcher_drop(zc_owned_keyexpr_matcher_t *matcher);
+
+/// Constructs `zc_owned_keyexpr_matcher_t`'s gravestone value
+ZENOHC_API zc_owned_keyexpr_matcher_t zc_keyexpr_matcher_null(void);
+
+// Options for session-level key expression interning cache
+typedef struct zc_keyexpr_cache_options_t
+{
+    // the maximal number of cached key expressions, the least recently used ones are evicted
+    size_t capacity;
+    // the number of uses after which the key expression is declared (see z_declare_keyexpr)
+    // and gets numeric wire id, 0 means never declare
+    size_t declare_threshold;
+} zc_keyexpr_cache_options_t;
+
+/// Constructs the default value for zc_keyexpr_cache_options_t
+ZENOHC_API zc_keyexpr_cache_options_t zc_keyexpr_cache_options_default(void);
+
+/// Enable key expression interning cache on the session
+/// @param session zenoh session
+/// @param options cache options, NULL means default options
+/// @returns 0 in case of success, negative value if the cache is already enabled
+ZENOHC_API int8_t zc_session_keyexpr_cache_enable(z_session_t session, const zc_keyexpr_cache_options_t *options);
+
+/// Intern the key expression built on the fly (e.g. with z_keyexpr_join or z_keyexpr_concat)
+/// Key expressions are deduplicated by content: the interned one shares the cached string instead of holding
+/// it's own heap copy, and once the key expression is hot it is automatically declared, so it is encoded on the
+/// wire with numeric id. Evicted key expressions are undeclared once the last interned handle is dropped
+/// @param session zenoh session with enabled cache
+/// @param keyexpr the key expression, it is consumed
+/// @returns the interned key expression, or keyexpr itself if the cache is not enabled
+ZENOHC_API z_owned_keyexpr_t zc_keyexpr_intern(z_session_t session, z_owned_keyexpr_t *keyexpr);
@@ -9,8 +9,12 @@
 // Unique protocol identifier
 // Here is a contract: it is up to the user to make sure that incompatible SharedMemoryClient
 // and SharedMemoryProviderBackend implementations will never use the same z_protocol_id_t
+// Ids below Z_SHM_DENSE_PROTOCOL_ID_LIMIT are resolved by direct array indexing, so prefer small ids
 typedef uint32_t z_protocol_id_t;
 
+// Protocol ids below this limit are looked up in a dense array, others - in a perfect hash table
+#define Z_SHM_DENSE_PROTOCOL_ID_LIMIT 64
+
 // Unique segment identifier
 typedef uint32_t z_segment_id_t;
 
@@ -33,6 +37,19 @@ enum z_alloc_result_t
     OTHER_ERROR = 3      // other error occured
 };
 
+// Client operation result enum
+// Returned by SharedMemoryClient and SharedMemorySegment callbacks instead of an error string, so
+// that the receive path never allocates. Human-readable details may be obtained lazily with
+// z_owned_shared_memory_client_t::describe or z_client_result_str
+enum z_client_result_t
+{
+    CLIENT_OK = 0,           // successful operation
+    SEGMENT_NOT_FOUND = 1,   // the segment with requested id does not exist (or is already gone)
+    SEGMENT_MAP_FAILED = 2,  // the segment exists, but it cannot be mapped into the process
+    CHUNK_OUT_OF_BOUNDS = 3, // the chunk id does not belong to the segment
+    CLIENT_OTHER_ERROR = 4   // other error occured
+};
+
 // Structure that represents an allocated chunk
 struct z_allocated_chunk_t
 {
@@ -40,17 +57,58 @@ struct z_allocated_chunk_t
     uint8_t *data;
 };
 
+// Segment layout kind enum
+enum z_segment_layout_kind_t
+{
+    LAYOUT_OPAQUE = 0, // chunk addresses are resolved by the segment's map callback
+    LAYOUT_STRIDE = 1, // chunk id is a chunk index: data = base + chunk * unit
+    LAYOUT_OFFSET = 2  // chunk id is an offset in units of alignment: data = base + (chunk << unit)
+};
+
+// Linear layout of the segment
+// If a segment declares non-opaque layout, Zenoh computes chunk addresses inline on the receive path,
+// without calling the map callback. The whole chunk data [data, data + len), where len is the payload
+// length received with the sample, must lie within [base, base + size), otherwise the chunk is rejected
+// as CHUNK_OUT_OF_BOUNDS (the check is overflow-safe, so corrupted descriptors never read outside of mapping)
+struct z_segment_layout_t
+{
+    z_segment_layout_kind_t kind;
+    // the start of the mapped segment
+    uint8_t *base;
+    // the mapped segment size in bytes
+    size_t size;
+    // stride in bytes for LAYOUT_STRIDE, log2 of offset alignment for LAYOUT_OFFSET
+    uint32_t unit;
+};
+
 //// INTERFACES ////
 
 typedef struct z_owned_shared_memory_segment_t
 {
     void *context;
+    /// Optional linear layout filled upon attachment
+    /// Zenoh zero-initializes the segment before passing it to attach, so clients that don't fill
+    /// layout get LAYOUT_OPAQUE (and map_batch == NULL) by default
+    /// If layout.kind is not LAYOUT_OPAQUE, map is never called and may be NULL
+    z_segment_layout_t layout;
     /// Obtain the actual region of memory identified by it's id
+    /// This is called for each received SHM sample, so it must not allocate
     /// @param chunk chunk identifier within a segment
-    /// @param error error message if error occured
+    /// @param data pointer to mapped data if succeed
+    /// @param context context
+    /// @returns mapping result
+    z_client_result_t (*map)(z_chunk_id_t chunk, uint8_t **data, void *context);
+
+    /// Optional: obtain the actual regions of memory for a number of chunks at once
+    /// When draining bursts of samples, Zenoh groups received chunks by segment and resolves each
+    /// group with a single call. Can be NULL, map is called for each chunk then
+    /// Like map, it is never called if layout.kind is not LAYOUT_OPAQUE
+    /// @param chunks array of chunk identifiers within a segment
+    /// @param data array of count elements to be filled with pointers to mapped data (NULL for failed chunks)
+    /// @param count number of elements in chunks and data
     /// @param context context
-    /// @returns pointer to mapped data or NULL if error occured
-    uint8_t *(*map)(z_chunk_id_t chunk, z_owned_str_t *error, void *context);
+    /// @returns CLIENT_OK if all chunks are mapped, the first error occured otherwise
+    z_client_result_t (*map_batch)(const z_chunk_id_t *chunks, uint8_t **data, size_t count, void *context);
     void (*drop)(void *);
 } z_owned_shared_memory_segment_t;
 
@@ -61,8 +119,19 @@ typedef struct z_owned_shared_memory_client_t
     /// @param id identifier of a segment
     /// @param segment the result of attachment
     /// @param context context
-    /// @returns non-empty error if any error occured
-    z_owned_str_t (*attach)(z_segment_id_t id, z_owned_shared_memory_segment_t *segment, void *context);
+    /// @returns attachment result
+    z_client_result_t (*attach)(z_segment_id_t id, z_owned_shared_memory_segment_t *segment, void *context);
+
+    /// Optional: format the detailed description of an error returned by attach or map
+    /// Called lazily, only when somebody actually asks for the message (logging, diagnostics)
+    /// Can be NULL, z_client_result_str is used then
+    /// @param result the error to describe
+    /// @param segment the segment the error relates to
+    /// @param buf the buffer to write null-terminated message into
+    /// @param len the size of buf
+    /// @param context context
+    /// @returns the number of characters written (excluding terminating null)
+    size_t (*describe)(z_client_result_t result, z_segment_id_t segment, char *buf, size_t len, void *context);
     void (*drop)(void *);
 } z_owned_shared_memory_client_t;
 
@@ -79,9 +148,17 @@ typedef struct z_owned_shared_memory_provider_backend_t
     /// @param len the desired data len
     /// @param chunk the allocated chunk if succeed
     /// @param context context
-    /// @returns allocation result
+    /// @returns allocation result (OUT_OF_MEMORY if len is bigger than the backend can allocate at once,
+    ///          OTHER_ERROR is reserved for failures that retrying with a smaller len won't fix)
     z_alloc_result_t (*alloc)(size_t len, z_allocated_chunk_t *chunk, void *context);
 
+    /// Optional: get the size of the largest chunk alloc can allocate right now
+    /// (the largest free chunk, or the static chunk size limit of the allocator)
+    /// Used by z_shared_memory_provider_alloc_fragmented to size the fragments. Can be NULL
+    /// @param context context
+    /// @returns the size in bytes, 0 if nothing can be allocated
+    size_t (*max_chunk_size)(void *context);
+
     /// Deallocate the chunk
     /// @param chunk the allocation result
     /// @param context context
@@ -93,6 +170,11 @@ typedef struct z_owned_shared_memory_provider_backend_t
     void (*drop)(void *);
 } z_owned_shared_memory_provider_backend_t;
 
+/// Get the static description of client result
+/// @param result the result to describe
+/// @returns null-terminated static string, never NULL
+ZENOHC_API const char *z_client_result_str(z_client_result_t result);
+
 // Shared memory provider handle
 typedef void *z_shared_memory_provider_t;
 
@@ -102,11 +184,34 @@ ZENOHC_API z_alloc_result_t z_shared_memory_provider_alloc(
     size_t len,
     zc_owned_shmbuf_t *result);
 
+/// Allocate the buffer of desired size as a number of fragments
+/// Designed for payloads bigger than the largest free chunk of provider: the allocation succeeds as long as
+/// there is enough total free memory. The fragments can be published as one payload with zc_shmbufs_into_payload
+/// @param provider the provider instance
+/// @param len the desired total length
+/// @param fragments array to be filled with allocated fragments in order, their lengths sum up to len
+/// @param capacity number of elements in fragments
+/// @param count will contain the number of allocated fragments
+/// @returns allocation result (OUT_OF_MEMORY if len cannot be covered with capacity fragments)
+/// The allocation is all-or-nothing: on failure all the partially allocated fragments are freed,
+/// fragments are filled with gravestone values and count is set to 0, so there is nothing to drop
+/// Each fragment is min(remaining length, max_chunk_size()) long. If the backend's max_chunk_size is NULL,
+/// the fragment size starts at len and is halved on every OUT_OF_MEMORY or NEED_DEFRAGMENT from alloc
+/// (down to 1 byte), so the backend is called O(log len) extra times per fragment. OTHER_ERROR from alloc
+/// fails the whole allocation
+ZENOHC_API z_alloc_result_t z_shared_memory_provider_alloc_fragmented(
+    z_shared_memory_provider_t provider,
+    size_t len,
+    zc_owned_shmbuf_t *fragments,
+    size_t capacity,
+    size_t *count);
+
 /// Defragment the memory
 ZENOHC_API void z_shared_memory_provider_defragment(z_shared_memory_provider_t provider);
 
 /// Map externally-allocated chunk into zc_owned_shmbuf_t
 /// This method is designed to be used with push data sources
+/// It is thread-safe and can be called concurrently from several producer threads
 /// @param provider the provider instance
 /// @param chunk the allocated chunk to map
 /// @param size the size of a chunk
@@ -118,6 +223,187 @@ ZENOHC_API zc_owned_shmbuf_t z_shared_memory_provider_map(
     size_t size,
     z_owned_str_t *error);
 
+// Built-in protocol used for chunks imported from file descriptors (see z_shared_memory_register_fd)
+// Every session has the client for this protocol, so there is no need to register one in the factory.
+// This id is reserved: z_shared_memory_factory_make, z_session_shared_memory_add_provider and
+// z_session_shared_memory_add_client reject user providers and clients registered with it
+//
+// An fd cannot be named by (segment, chunk) pair across processes, so the fd itself is transferred:
+// each registered fd gets a segment id, and a local subscriber process attaching to such segment receives
+// the duplicated fd from the publisher session over a local unix socket with SCM_RIGHTS (the publisher
+// accepts the connection only from peers of the same host and user). Chunks imported from a registered fd
+// are sent as (segment, offset) pairs, so the fd is transferred and mapped once per segment, not per sample.
+// Remote peers (other hosts) can't map the fd and receive the payload copied by value
+#define Z_SHM_FD_PROTOCOL_ID 0xFFFFFFFF
+
+// Registered file descriptor (see z_shared_memory_register_fd)
+typedef struct z_owned_shared_memory_fd_t
+{
+    void *_0;
+} z_owned_shared_memory_fd_t;
+
+/// Register the memory referenced by a file descriptor (memfd, dma-buf, etc) as shared memory segment
+/// This method is designed to be used with producers that already hold their buffers as file descriptors
+/// (V4L2, video decoders, other processes): register each buffer once, then import every frame placed in it
+/// with z_shared_memory_import_fd, subscribers map the same pages, no copy is made.
+/// Registering the same underlying file again (same st_dev and st_ino, e.g. another fd of the same dma-buf)
+/// returns a handle to the already registered segment
+/// @param session zenoh session
+/// @param fd the file descriptor, it is duplicated, so the caller keeps the ownership of fd
+/// @param result will contain the registration result: SEGMENT_MAP_FAILED if fd cannot be mapped
+/// @returns the registered fd, or the gravestone value if error occured
+ZENOHC_API z_owned_shared_memory_fd_t z_shared_memory_register_fd(
+    z_session_t session,
+    int fd,
+    z_client_result_t *result);
+
+/// Returns `false` if `fd` is the gravestone value
+ZENOHC_API bool z_shared_memory_fd_check(const z_owned_shared_memory_fd_t *fd);
+
+/// Unregister the fd
+/// The segment (and zenoh's duplicate of fd) is released once the last handle is dropped and
+/// all the chunks imported from it are released by zenoh and all subscribers
+ZENOHC_API void z_shared_memory_fd_drop(z_owned_shared_memory_fd_t *fd);
+
+/// Constructs `z_owned_shared_memory_fd_t`'s gravestone value
+ZENOHC_API z_owned_shared_memory_fd_t z_shared_memory_fd_null(void);
+
+/// Import the region of the registered fd as shared memory buffer
+/// This is cheap and designed to be called per frame: no fd is duplicated or transferred and nothing is mapped
+/// @param fd the registered fd
+/// @param offset the offset of data within fd
+/// @param len the length of data
+/// @param on_release optional callback called once the buffer is released by zenoh and all subscribers
+///                   (e.g. to requeue V4L2 buffer), can be NULL
+/// @param context context for on_release
+/// @param result will contain the import result: CHUNK_OUT_OF_BOUNDS if [offset, offset + len) is outside of fd
+/// @returns valid shm buffer handle, or invalid if error occured
+ZENOHC_API zc_owned_shmbuf_t z_shared_memory_import_fd(
+    const z_owned_shared_memory_fd_t *fd,
+    size_t offset,
+    size_t len,
+    void (*on_release)(void *context),
+    void *context,
+    z_client_result_t *result);
+
+// Ring operation result enum
+enum z_ring_result_t
+{
+    RING_OK = 0,  // successful operation
+    RING_FULL = 1 // all slots are either being filled or still referenced by subscribers
+};
+
+// Ring publication mode enum
+enum z_ring_publication_mode_t
+{
+    RING_UNORDERED = 0, // each slot is sent as soon as it's published
+    RING_ORDERED = 1    // slots are sent in acquisition order: a slot published ahead of it's predecessors
+                        // is queued (without blocking the producer) and sent as soon as all of it's predecessors
+                        // are either published, released (see z_shared_memory_ring_release) or skipped on timeout
+};
+
+// Options for ring creation
+typedef struct z_shared_memory_ring_options_t
+{
+    z_ring_publication_mode_t mode;
+    // RING_ORDERED only: the maximal time a slot may stay acquired while later slots wait for it. Once it
+    // expires, the slot is skipped: the queued successors are sent, and a late z_shared_memory_ring_publish
+    // of the skipped slot fails and returns the slot to the ring. 0 means no timeout, so a producer that
+    // never publishes nor releases it's slot stalls all the later slots
+    // There is no background thread: the timeout is checked by the ring calls themselves (acquire, publish,
+    // release and z_shared_memory_ring_poll), so an expired slot is skipped on the first such call after
+    // the expiration. If no producer calls into the ring, no progress is made
+    uint32_t ordered_timeout_ms;
+} z_shared_memory_ring_options_t;
+
+/// Constructs the default value for z_shared_memory_ring_options_t
+ZENOHC_API z_shared_memory_ring_options_t z_shared_memory_ring_options_default(void);
+
+// Preallocated ring of frame slots for push data sources
+// The slots are allocated from the provider once, upon ring creation, so publishing a slot
+// involves no allocation, mapping or chunk validation. A published slot returns to the ring
+// once all subscribers release it
+// Acquire and publish are lock-free and can be called concurrently from any number of producer threads
+// (e.g. several DMA completion threads)
+typedef struct z_owned_shared_memory_ring_t
+{
+    void *_0;
+} z_owned_shared_memory_ring_t;
+
+/// Create the ring of fixed-size slots allocated from the provider
+/// @param provider the provider instance
+/// @param slot_count number of slots in the ring
+/// @param slot_size the size of each slot
+/// @param options ring options, NULL means default options
+/// @param result allocation result
+/// @returns the ring handle, or the gravestone value if allocation failed (see z_shared_memory_ring_check)
+ZENOHC_API z_owned_shared_memory_ring_t z_shared_memory_ring_new(
+    z_shared_memory_provider_t provider,
+    size_t slot_count,
+    size_t slot_size,
+    const z_shared_memory_ring_options_t *options,
+    z_alloc_result_t *result);
+
+/// Get the number of slots in the ring
+ZENOHC_API size_t z_shared_memory_ring_slot_count(z_owned_shared_memory_ring_t ring);
+
+/// Get the size of each slot in the ring
+ZENOHC_API size_t z_shared_memory_ring_slot_size(z_owned_shared_memory_ring_t ring);
+
+/// Get the data pointer of a slot
+/// Slot addresses are stable for the ring lifetime, so they can be registered in the device library upfront
+/// @param ring the ring instance
+/// @param index slot index
+/// @returns pointer to slot data
+ZENOHC_API uint8_t *z_shared_memory_ring_slot_ptr(z_owned_shared_memory_ring_t ring, size_t index);
+
+/// Acquire the next free slot for filling
+/// The slot is claimed with a single atomic operation, no locks are taken
+/// @param ring the ring instance
+/// @param index will contain acquired slot index
+/// @returns RING_OK, or RING_FULL if subscribers haven't released enough slots yet
+ZENOHC_API z_ring_result_t z_shared_memory_ring_acquire(z_owned_shared_memory_ring_t ring, size_t *index);
+
+/// Publish the filled slot
+/// The slot is consumed: it becomes available for z_shared_memory_ring_acquire once all subscribers release it
+/// @param publisher zenoh publisher
+/// @param ring the ring instance
+/// @param index the slot index obtained from z_shared_memory_ring_acquire
+/// @param len the length of data in the slot
+/// @param options publisher put options
+/// @returns 0 in case of success, negative value in case of failure (including the slot skipped on
+///          ordered_timeout_ms, which is returned to the ring then)
+ZENOHC_API int8_t z_shared_memory_ring_publish(
+    z_publisher_t publisher,
+    z_owned_shared_memory_ring_t ring,
+    size_t index,
+    size_t len,
+    const z_publisher_put_options_t *options);
+
+/// Give the acquired slot back to the ring without publishing it (e.g. if filling the frame failed)
+/// The slot becomes available for z_shared_memory_ring_acquire immediately
+/// In RING_ORDERED mode the slot is skipped, so the queued successors are sent without waiting for it
+/// @param ring the ring instance
+/// @param index the slot index obtained from z_shared_memory_ring_acquire
+ZENOHC_API void z_shared_memory_ring_release(z_owned_shared_memory_ring_t ring, size_t index);
+
+/// Skip the expired slots and send their queued successors (RING_ORDERED with ordered_timeout_ms only)
+/// Meant for producers that may go idle with queued slots (e.g. at the end of a stream), as acquire,
+/// publish and release do the same check anyway. Lock-free, does nothing in RING_UNORDERED mode
+/// @param ring the ring instance
+/// @returns the number of skipped slots
+ZENOHC_API size_t z_shared_memory_ring_poll(z_owned_shared_memory_ring_t ring);
+
+/// Drop the ring
+/// The slots are returned to the provider once all subscribers release them
+ZENOHC_API void z_shared_memory_ring_drop(z_owned_shared_memory_ring_t *ring);
+
+/// Returns `false` if `ring` is the gravestone value
+ZENOHC_API bool z_shared_memory_ring_check(const z_owned_shared_memory_ring_t *ring);
+
+/// Constructs `z_owned_shared_memory_ring_t`'s gravestone value
+ZENOHC_API z_owned_shared_memory_ring_t z_shared_memory_ring_null(void);
+
 // struct for provider mappings
 typedef struct z_shared_memory_mapped_providers_t
 {
@@ -138,8 +424,11 @@ typedef void *z_owned_shared_memory_factory_t;
 /// Create shared memory factory
 /// @param map pointer to array containing providers and\or clients for particular protocols
 /// @param map_len number of elements in array
-/// @param error will contain error if smth went wrong
+/// @param error will contain error if smth went wrong (e.g. the same protocol id is used twice,
+///              or the reserved Z_SHM_FD_PROTOCOL_ID is used)
 /// @returns the shared memory factory handle
+/// The factory is immutable: upon creation it builds a compact protocol-indexed dispatch table
+/// (see Z_SHM_DENSE_PROTOCOL_ID_LIMIT), so every later lookup by z_protocol_id_t is O(1)
 ZENOHC_API z_owned_shared_memory_factory_t z_shared_memory_factory_make(
     z_shared_memory_mapped_providers_t *providers,
     size_t providers_count,
@@ -157,3 +446,661 @@ ZENOHC_API z_shared_memory_provider_t z_shared_memory_factory_provider(z_protoco
 /// @param id protocol id
 /// @returns the shared memory provider (can be invalid if there is no provider for particular id)
 ZENOHC_API z_shared_memory_provider_t z_session_shared_memory_provider(z_owned_session_t session, z_protocol_id_t id);
+
+/// Register shared memory provider on a running session
+/// The session's dispatch table is never modified in place: a new immutable table is built and published
+/// RCU-style, so in-flight samples and concurrent lookups are never blocked
+/// @param session zenoh session
+/// @param provider the provider to register, ownership of provider->backend is transferred to the session
+/// @returns 0 in case of success, negative value if provider for particular id is already registered
+///          or the id is the reserved Z_SHM_FD_PROTOCOL_ID
+ZENOHC_API int8_t z_session_shared_memory_add_provider(z_session_t session, z_shared_memory_mapped_providers_t *provider);
+
+/// Unregister shared memory provider from a running session
+/// The provider is unpublished immediately: further lookups fail and allocations through previously
+/// obtained handles return OTHER_ERROR. The backend is dropped once all chunks allocated from it are freed
+/// @param session zenoh session
+/// @param id protocol id
+/// @returns 0 in case of success, negative value if there is no provider for particular id
+ZENOHC_API int8_t z_session_shared_memory_remove_provider(z_session_t session, z_protocol_id_t id);
+
+/// Register shared memory client on a running session
+/// The dispatch table is republished RCU-style, so in-flight samples are never blocked
+/// The updated protocol set is advertised to connected peers
+/// @param session zenoh session
+/// @param client the client to register, ownership of client->client is transferred to the session
+/// @returns 0 in case of success, negative value if client for particular id is already registered
+///          or the id is the reserved Z_SHM_FD_PROTOCOL_ID
+ZENOHC_API int8_t z_session_shared_memory_add_client(z_session_t session, z_shared_memory_mapped_clients_t *client);
+
+/// Unregister shared memory client from a running session
+/// The client is unpublished immediately, so newly received samples of this protocol are not mapped anymore.
+/// Segments attached by the client are drained: they are dropped once all samples referencing them are
+/// released, and the client itself is dropped after it's last segment
+/// @param session zenoh session
+/// @param id protocol id
+/// @returns 0 in case of success, negative value if there is no client for particular id
+ZENOHC_API int8_t z_session_shared_memory_remove_client(z_session_t session, z_protocol_id_t id);
+
+// Options for binding shared memory provider to the publisher
+typedef struct z_publisher_shm_options_t
+{
+    // z_publisher_put places payloads of len > threshold into a buffer allocated from the bound provider
+    // and sends other payloads inline (0 - always use SHM for non-empty payloads, SIZE_MAX - never use SHM).
+    // If allocation fails, the payload is sent inline
+    // Ignored if auto_calibrate is set
+    size_t threshold;
+    // calibrate the threshold by a micro-benchmark (run once per provider) comparing SHM bookkeeping cost
+    // against copying through the network path, true by default
+    bool auto_calibrate;
+    // split payloads bigger than the largest free chunk across several chunks (see
+    // z_shared_memory_provider_alloc_fragmented) instead of sending them inline, false by default.
+    // Only subscribers accepting segmented payloads (see zc_closure_sample_segmented) get the fragments,
+    // all others get the payload contiguous
+    bool fragment;
+} z_publisher_shm_options_t;
+
+/// Constructs the default value for z_publisher_shm_options_t
+ZENOHC_API z_publisher_shm_options_t z_publisher_shm_options_default(void);
+
+/// Construct an owned payload from an ordered list of SHM buffers
+/// The buffers may come from different providers and protocols (e.g. a small header and a large camera frame).
+/// The payload is transmitted as a list of SHM descriptors, no coalescing copy is made for subscribers that
+/// accept segmented payloads (see zc_closure_sample_segmented). All other subscribers get a contiguous payload:
+/// remote peers that didn't opt in, or are unable to map some of the protocols, receive the payload coalesced
+/// by the publisher and copied by value (like for peers without the matching client), and local subscribers
+/// that didn't opt in get a contiguous copy made once per sample, only if there is such a subscriber
+/// @param bufs array of buffers, all of them are consumed
+/// @param count number of elements in bufs
+/// @returns the payload, or gravestone value if any of bufs is invalid
+ZENOHC_API zc_owned_payload_t zc_shmbufs_into_payload(zc_owned_shmbuf_t *bufs, size_t count);
+
+/// Mark the sample closure as accepting segmented payloads, pass the result to z_declare_subscriber
+/// Segmented payloads are opt-in: subscribers declared with a plain closure always get contiguous
+/// sample->payload, so existing callbacks keep working. Subscribers declared with the marked closure advertise
+/// this capability to publishers, and get multi-slice payloads without any coalescing copy: for those
+/// sample->payload.start is NULL and sample->payload.len is the total length, so the payload must be accessed
+/// with z_sample_payload_slices
+/// @param callback the closure to mark, it is consumed
+/// @returns the marked closure
+ZENOHC_API z_owned_closure_sample_t zc_closure_sample_segmented(z_owned_closure_sample_t *callback);
+
+/// Get the iovec-style view of the sample's payload
+/// For contiguous payloads (including all payloads delivered to subscribers that didn't opt in with
+/// zc_closure_sample_segmented) the only slice is sample->payload
+/// @param sample the sample
+/// @param slices array to be filled with slices in order, can be NULL
+/// @param capacity number of elements in slices
+/// @returns the total number of slices in the payload (can be greater than capacity)
+ZENOHC_API size_t z_sample_payload_slices(const z_sample_t *sample, z_bytes_t *slices, size_t capacity);
+
+// Iterator over the slices of the sample's or owned payload
+typedef struct z_payload_slice_iterator_t
+{
+    const void *_payload;
+    size_t _index;
+} z_payload_slice_iterator_t;
+
+/// Get the iterator over the slices of the sample's payload
+/// The iterator is valid as long as the sample is valid
+ZENOHC_API z_payload_slice_iterator_t z_sample_payload_slices_iter(const z_sample_t *sample);
+
+/// Get the next slice of the payload
+/// @param iter the iterator
+/// @param slice will contain the read-only slice
+/// @returns false if there are no more slices
+ZENOHC_API bool z_payload_slice_iterator_next(z_payload_slice_iterator_t *iter, z_bytes_t *slice);
+
+/// Get the sample's payload in contiguous memory, for consumers that need contiguity
+/// If the payload is already contiguous, it's refcount is just incremented (like zc_sample_payload_rcinc),
+/// otherwise the slices are copied into a new buffer
+ZENOHC_API zc_owned_payload_t zc_sample_payload_linearize(const z_sample_t *sample);
+
+/// Get the iovec-style view of the owned payload (e.g. the payload of zc_owned_sample_t)
+/// Owned payloads keep the segmentation of the sample they were obtained from: for multi-slice payloads
+/// payload->payload.start is NULL and payload->payload.len is the total length
+/// @param payload the payload
+/// @param slices array to be filled with slices in order, can be NULL
+/// @param capacity number of elements in slices
+/// @returns the total number of slices in the payload (can be greater than capacity)
+ZENOHC_API size_t zc_payload_slices(const zc_owned_payload_t *payload, z_bytes_t *slices, size_t capacity);
+
+/// Get the iterator over the slices of the owned payload
+/// The iterator is valid as long as the payload is valid
+ZENOHC_API z_payload_slice_iterator_t zc_payload_slices_iter(const zc_owned_payload_t *payload);
+
+/// Get the owned payload in contiguous memory
+/// If the payload is already contiguous, it's refcount is just incremented (like zc_payload_rcinc),
+/// otherwise the slices are copied into a new buffer
+ZENOHC_API zc_owned_payload_t zc_payload_linearize(const zc_owned_payload_t *payload);
+
+/// Send a number of PUT messages onto the publisher's key expression in one call, transfering the buffers ownership
+/// All the payloads are encoded as a single batched transport message carrying many SHM descriptors,
+/// so the locks are taken and the frame header is encoded once per batch instead of once per payload
+/// @param publisher zenoh publisher
+/// @param payloads array of payloads, all of them are consumed even if the operation fails
+/// @param options array of count per-payload put options, can be NULL (default options are used then)
+/// @param count number of elements in payloads and options
+/// @returns 0 in case of success, negative value in case of failure
+ZENOHC_API int8_t zc_publisher_put_owned_batch(
+    z_publisher_t publisher,
+    zc_owned_payload_t *payloads,
+    const z_publisher_put_options_t *options,
+    size_t count);
+
+// Sessions exchange the sets of protocols they have clients for upon connection and every time
+// a client is added or removed. The set is cached per peer and used by publications: SHM references
+// are sent only to peers able to map the protocol of the buffer, while the payload is copied
+// once and sent by value to all other peers
+
+/// Get the shared memory protocols supported by a remote peer
+/// @param session zenoh session
+/// @param peer the id of remote peer (see z_info_peers_zid)
+/// @param protocols array to be filled with supported protocol ids, can be NULL
+/// @param capacity number of elements in protocols
+/// @returns the total number of protocols supported by the peer (can be greater than capacity)
+ZENOHC_API size_t z_session_shared_memory_peer_protocols(
+    z_session_t session,
+    const z_id_t *peer,
+    z_protocol_id_t *protocols,
+    size_t capacity);
+
+/// Check if a remote peer is able to map the shared memory buffers of particular protocol
+/// @param session zenoh session
+/// @param peer the id of remote peer
+/// @param id protocol id
+/// @returns true if the peer has a client registered for the protocol
+ZENOHC_API bool z_session_shared_memory_peer_supports(z_session_t session, const z_id_t *peer, z_protocol_id_t id);
+
+// Options for low-latency local delivery
+typedef struct z_shm_local_delivery_options_t
+{
+    // the number of slots in notification ring shared with each local peer
+    // If the ring is full (the subscriber doesn't keep up), the sample falls back to the transport, so the
+    // publisher is never blocked by the ring (see z_session_shared_memory_enable_local_delivery for ordering)
+    size_t ring_size;
+    // the number of empty ring polls before parking on futex, 0 means park immediately
+    uint32_t spin_iterations;
+} z_shm_local_delivery_options_t;
+
+/// Constructs the default value for z_shm_local_delivery_options_t
+ZENOHC_API z_shm_local_delivery_options_t z_shm_local_delivery_options_default(void);
+
+/// Enable low-latency local delivery of SHM samples
+/// For peers on the same host that enabled local delivery too, SHM samples bypass the transport: the publisher
+/// writes sample descriptor into the notification ring located in shared memory, and wakes the subscriber
+/// with futex only if it is parked. The receiving side spins on the ring for spin_iterations and then parks,
+/// so the sample delivery costs neither socket syscall nor scheduler wakeup while traffic is flowing.
+/// Non-SHM samples (e.g. below the publisher's SHM threshold), samples that fell back on full ring and
+/// samples for remote peers go through the transport as usual.
+/// Ordering: a publisher's samples to a local peer may thus take either path, and each path is FIFO on it's own.
+/// To keep them in publication order, every sample carries a per-publisher sequence number and the subscriber
+/// merges both paths by it: a sample that overtook it's predecessors on the other path is held back until they
+/// are delivered. A missing sequence number is given up once both paths have delivered a later sample (it was
+/// dropped by congestion control and can't arrive any more), so the merge never stalls on a lost sample.
+/// Held back samples are delivered from the thread that delivers the missing predecessor
+/// @param session zenoh session
+/// @param options local delivery options, NULL means default options
+/// @returns 0 in case of success, negative value in case of failure
+ZENOHC_API int8_t z_session_shared_memory_enable_local_delivery(
+    z_session_t session,
+    const z_shm_local_delivery_options_t *options);
+
+/// Resolve the shared memory provider once and bind it to the publisher
+/// The bound provider handle is cached in the publisher, so the publication hot path never does a lookup
+/// Once bound, z_publisher_put transparently selects between SHM and inline payloads (see z_publisher_shm_options_t)
+/// @param publisher zenoh publisher
+/// @param id protocol id
+/// @param options binding options, NULL means default options
+/// @returns 0 in case of success, negative value if there is no provider for particular id
+ZENOHC_API int8_t z_publisher_bind_shared_memory_provider(
+    z_publisher_t publisher,
+    z_protocol_id_t id,
+    const z_publisher_shm_options_t *options);
+
+/// Create a fixed pool of SHM buffers for the publisher
+/// All the buffers are allocated from the bound provider at once (see z_publisher_bind_shared_memory_provider),
+/// so steady-state publishing does no allocator calls. A loaned buffer returns to the pool automatically
+/// once it is dropped unpublished, or once it is published and all subscribers release it
+/// @param publisher zenoh publisher with bound shared memory provider
+/// @param buffer_count number of buffers in the pool
+/// @param buffer_size the capacity of each buffer
+/// @returns allocation result (OTHER_ERROR if there is no provider bound or the pool already exists)
+ZENOHC_API z_alloc_result_t z_publisher_shared_memory_pool_init(
+    z_publisher_t publisher,
+    size_t buffer_count,
+    size_t buffer_size);
+
+/// Loan writable buffer from the publisher's pool
+/// @param publisher zenoh publisher with pool created by z_publisher_shared_memory_pool_init
+/// @param result the loaned buffer if succeed, it's length is defaulted to the pool's buffer size
+/// @returns OK, or OUT_OF_MEMORY if all the buffers are either loaned or still referenced by subscribers
+ZENOHC_API z_alloc_result_t z_publisher_shared_memory_loan(z_publisher_t publisher, zc_owned_shmbuf_t *result);
+
+/// Get the SHM-vs-inline threshold of the publisher
+/// @param publisher zenoh publisher
+/// @returns the threshold (calibrated one if auto_calibrate was requested), or SIZE_MAX if no provider is bound
+ZENOHC_API size_t z_publisher_shared_memory_threshold(z_publisher_t publisher);
+
+/// Get the shared memory provider bound to the publisher
+/// @param publisher zenoh publisher
+/// @returns the shared memory provider (can be invalid if no provider is bound)
+ZENOHC_API z_shared_memory_provider_t z_publisher_shared_memory_provider(z_publisher_t publisher);
+
+//// SAMPLE CHANNELS ////
+
+// Owned sample
+// Unlike z_sample_t, which is valid only inside the subscriber callback, owned sample can be kept
+// as long as needed. It's payload is obtained with zc_sample_payload_rcinc, so SHM payloads are not copied
+// The payload keeps it's segmentation, it should be read with zc_payload_slices or zc_payload_slices_iter
+typedef struct zc_owned_sample_t
+{
+    z_owned_keyexpr_t keyexpr;
+    zc_owned_payload_t payload;
+    z_owned_encoding_t encoding;
+    z_sample_kind_t kind;
+    z_timestamp_t timestamp;
+} zc_owned_sample_t;
+
+/// Make owned sample from the loaned one (no payload copy is made)
+ZENOHC_API zc_owned_sample_t zc_sample_to_owned(const z_sample_t *sample);
+
+/// Returns `false` if `sample` is the gravestone value
+ZENOHC_API bool zc_sample_check(const zc_owned_sample_t *sample);
+
+/// Drops the sample, releasing it's payload
+ZENOHC_API void zc_sample_drop(zc_owned_sample_t *sample);
+
+/// Constructs `zc_owned_sample_t`'s gravestone value
+ZENOHC_API zc_owned_sample_t zc_sample_null(void);
+
+// Channel overflow policy enum
+enum zc_channel_overflow_t
+{
+    CHANNEL_BLOCK = 0,       // sender is blocked until there is room in the channel (applies back-pressure)
+    CHANNEL_DROP_NEWEST = 1, // the incoming sample is dropped
+    CHANNEL_DROP_OLDEST = 2, // the oldest queued sample is dropped (and it's payload released)
+    CHANNEL_CONFLATE = 3     // the channel keeps only the latest sample per key expression: the incoming sample
+                             // atomically replaces the queued one with the same key expression, and the replaced
+                             // payload is released immediately. Here bound limits the number of distinct key
+                             // expressions, samples of new key expressions are dropped once it's reached
+};
+
+// Receive result enum
+enum zc_recv_result_t
+{
+    RECV_OK = 0,          // the sample is received
+    RECV_EMPTY = 1,       // there are no samples in the channel (non-blocking receive only)
+    RECV_DISCONNECTED = 2 // the send end is dropped and all samples have been consumed
+};
+
+// Options for sample channel creation
+typedef struct zc_sample_channel_options_t
+{
+    // the channel capacity, must be greater than 0
+    // It counts queued samples, except for CHANNEL_CONFLATE where it counts distinct key expressions instead
+    size_t bound;
+    zc_channel_overflow_t overflow;
+    // create pollable fd for the receiver (see zc_sample_receiver_fd)
+    bool pollable;
+    // accept segmented payloads (like zc_closure_sample_segmented), otherwise queued payloads are contiguous.
+    // Segmented payloads of owned samples are accessed with zc_payload_slices
+    bool segmented;
+} zc_sample_channel_options_t;
+
+/// Constructs the default value for zc_sample_channel_options_t
+ZENOHC_API zc_sample_channel_options_t zc_sample_channel_options_default(void);
+
+// The receive end of the sample channel
+typedef struct zc_owned_sample_receiver_t
+{
+    void *_0;
+} zc_owned_sample_receiver_t;
+
+// Sample channel, returned as a pair of the send closure and the receiver
+typedef struct zc_owned_sample_channel_t
+{
+    // should be passed as callback to z_declare_subscriber
+    z_owned_closure_sample_t send;
+    zc_owned_sample_receiver_t recv;
+} zc_owned_sample_channel_t;
+
+/// Create a new lock-free bounded sample channel
+/// The send closure only moves the owned sample into the channel, so user code never runs on zenoh's threads.
+/// With CHANNEL_CONFLATE policy at most bound SHM buffers are queued in the channel, plus those the consumer
+/// still holds from already received samples, so the consumer that drops each sample before receiving the next
+/// one can't exhaust the producer's pool; the samples are received in order of their key expressions' first
+/// pending update
+/// The channel is multi-producer (subscriber callbacks may be called concurrently) and single-consumer
+/// @param options channel options, NULL means default options
+ZENOHC_API zc_owned_sample_channel_t zc_sample_channel_new(const zc_sample_channel_options_t *options);
+
+/// Receive the sample, blocking until one is available
+/// @param recv the receiver
+/// @param sample will contain the received sample
+/// @returns RECV_OK, or RECV_DISCONNECTED
+ZENOHC_API zc_recv_result_t zc_sample_receiver_recv(const zc_owned_sample_receiver_t *recv, zc_owned_sample_t *sample);
+
+/// Receive the sample if there is one
+/// @param recv the receiver
+/// @param sample will contain the received sample
+/// @returns RECV_OK, RECV_EMPTY or RECV_DISCONNECTED
+ZENOHC_API zc_recv_result_t zc_sample_receiver_try_recv(const zc_owned_sample_receiver_t *recv, zc_owned_sample_t *sample);
+
+/// Drain up to capacity queued samples without blocking
+/// @param recv the receiver
+/// @param samples array to be filled with received samples
+/// @param capacity number of elements in samples
+/// @returns the number of received samples
+ZENOHC_API size_t zc_sample_receiver_recv_batch(const zc_owned_sample_receiver_t *recv, zc_owned_sample_t *samples, size_t capacity);
+
+/// Get the pollable file descriptor of the receiver, for use in external event loops (epoll, poll, select)
+/// The fd (eventfd on Linux) is readable while there are samples queued. Wakeups are coalesced: it is signalled
+/// only when the channel turns from empty to non-empty, so a burst of samples costs one epoll_wait return.
+/// When a receive function finds the channel empty, it resets the fd first, then re-checks the queue and
+/// re-signals the fd if a sample was pushed in between, so no wakeup is lost. The user should drain the channel
+/// (e.g. with zc_sample_receiver_recv_batch until it returns 0) and should never read the fd directly
+/// @param recv the receiver of channel created with pollable option
+/// @returns the file descriptor owned by the receiver, or -1 if the channel is not pollable
+ZENOHC_API int zc_sample_receiver_fd(const zc_owned_sample_receiver_t *recv);
+
+/// Returns `false` if `recv` is the gravestone value
+ZENOHC_API bool zc_sample_receiver_check(const zc_owned_sample_receiver_t *recv);
+
+/// Drops the receiver, releasing all queued samples
+ZENOHC_API void zc_sample_receiver_drop(zc_owned_sample_receiver_t *recv);
+
+/// Constructs `zc_owned_sample_receiver_t`'s gravestone value
+ZENOHC_API zc_owned_sample_receiver_t zc_sample_receiver_null(void);
+
+/// Pull available data for the pull subscriber into the caller-provided array
+/// Unlike z_subscriber_pull, the samples are not passed to the subscriber's callback one by one:
+/// up to capacity samples are moved into the array at once, SHM payloads are not copied.
+/// If the subscriber's local batch queue is empty, the call sends a pull request to the router (like
+/// z_subscriber_pull does) and blocks until the router's reply is complete or timeout_ms expires.
+/// Samples of the reply that don't fit into the array stay in the local batch queue: the next calls
+/// return them first, without sending a new pull request until the queue is drained.
+/// Samples of the replies that complete after the timeout are appended to the local batch queue too.
+/// The subscriber's callback is never called for the samples pulled with this function, it still
+/// receives the samples pulled with z_subscriber_pull
+/// @param sub the pull subscriber
+/// @param samples array to be filled with pulled samples
+/// @param capacity number of elements in samples
+/// @param timeout_ms the maximal time to wait for the router's reply, 0 means don't wait (only drain the local queue)
+/// @param count will contain the number of pulled samples
+/// @returns the number of samples left in the local batch queue after this call
+ZENOHC_API size_t zc_subscriber_pull_batch(
+    z_pull_subscriber_t sub,
+    zc_owned_sample_t *samples,
+    size_t capacity,
+    uint32_t timeout_ms,
+    size_t *count);
+
+//// CALLBACK EXECUTORS ////
+
+// Executor ordering enum
+// Samples of one stream are delivered in order and never concurrently, independent streams are processed in parallel
+enum zc_executor_ordering_t
+{
+    ORDER_PER_KEYEXPR = 0,  // stream is identified by the sample's key expression
+    ORDER_PER_PUBLISHER = 1 // stream is identified by the publisher that sent the sample: the pair of the
+                            // publisher's session zid and publisher entity id, taken from the source info
+                            // attached to the sample on the wire (it is not part of z_sample_t, the sample's
+                            // timestamp is not used). Samples without source info (e.g. published by peers
+                            // that don't send it) fall back to ORDER_PER_KEYEXPR
+};
+
+// Options for executor creation
+typedef struct zc_executor_options_t
+{
+    // the number of worker threads, 0 means the number of available cores
+    size_t workers;
+} zc_executor_options_t;
+
+/// Constructs the default value for zc_executor_options_t
+ZENOHC_API zc_executor_options_t zc_executor_options_default(void);
+
+// Worker pool running subscriber callbacks off zenoh's RX threads
+// Each stream is bound to a queue, workers steal whole queues from each other when idle,
+// so a slow callback delays only the samples of it's own stream
+typedef struct zc_owned_executor_t
+{
+    void *_0;
+} zc_owned_executor_t;
+
+/// Create a new executor
+/// @param options executor options, NULL means default options
+ZENOHC_API zc_owned_executor_t zc_executor_new(const zc_executor_options_t *options);
+
+/// Wrap the sample closure to be called on the executor's workers
+/// The returned closure only queues the sample (the payload is kept alive with zc_sample_payload_rcinc,
+/// no copy is made), so it should be passed to z_declare_subscriber instead of callback
+/// @param executor the executor, it is kept alive by the returned closure
+/// @param callback the closure to wrap, it is consumed
+/// @param ordering the ordering guarantee
+/// @returns the wrapping closure
+ZENOHC_API z_owned_closure_sample_t zc_executor_closure_sample(
+    const zc_owned_executor_t *executor,
+    z_owned_closure_sample_t *callback,
+    zc_executor_ordering_t ordering);
+
+/// Returns `false` if `executor` is the gravestone value
+ZENOHC_API bool zc_executor_check(const zc_owned_executor_t *executor);
+
+/// Drops the executor handle, workers are stopped once all wrapping closures are dropped
+ZENOHC_API void zc_executor_drop(zc_owned_executor_t *executor);
+
+/// Constructs `zc_owned_executor_t`'s gravestone value
+ZENOHC_API zc_owned_executor_t zc_executor_null(void);
+
+//// STATE TOPICS ////
+
+// State topic is the latest value of high-rate state (joint states, pose, etc) kept in a single SHM slot.
+// The publisher overwrites the slot in place under a seqlock placed in shared memory, and subscribers
+// read the latest consistent snapshot directly from the slot: no allocation and no message per update.
+// The slot is allocated once from the publisher's provider and is announced to subscribers upon discovery,
+// so subscribers need the client for the provider's protocol
+
+// Options for state topics
+typedef struct z_state_topic_options_t
+{
+    // minimal interval between change notifications sent to subscribers, 0 means no notifications
+    uint32_t notify_interval_ms;
+    // subscriber only (ignored by the publisher): the maximal number of retries after the first read attempt
+    // found the publisher overwriting the slot (see z_state_subscriber_read), 64 by default.
+    // 0 means the slot is read once and never retried
+    uint32_t read_retries;
+} z_state_topic_options_t;
+
+// State read result enum
+enum z_state_result_t
+{
+    STATE_OK = 0,        // the consistent snapshot is read
+    STATE_NOT_READY = 1, // the publisher is not discovered yet
+    STATE_TOO_SMALL = 2, // the buffer is too small for the state
+    STATE_BUSY = 3       // no consistent snapshot within read_retries retries: the publisher is overwriting
+                         // the slot too often, or it has crashed in the middle of writing
+};
+
+/// Constructs the default value for z_state_topic_options_t
+ZENOHC_API z_state_topic_options_t z_state_topic_options_default(void);
+
+// Closure called on state change notifications
+// It has the same guarantees as other zenoh closures (see z_owned_closure_sample_t)
+typedef struct z_owned_closure_state_t
+{
+    void *context;
+    /// @param version the version of the state at the moment of notification
+    /// @param context context
+    void (*call)(uint64_t version, void *context);
+    void (*drop)(void *);
+} z_owned_closure_state_t;
+
+typedef struct z_owned_state_publisher_t
+{
+    void *_0;
+} z_owned_state_publisher_t;
+
+typedef struct z_owned_state_subscriber_t
+{
+    void *_0;
+} z_owned_state_subscriber_t;
+
+/// Declare state publisher
+/// @param session zenoh session
+/// @param keyexpr the key expression of the state topic
+/// @param provider the provider to allocate the slot from
+/// @param size the size of the state
+/// @param options state topic options, NULL means default options
+/// @returns the state publisher, or invalid if slot allocation failed
+ZENOHC_API z_owned_state_publisher_t z_declare_state_publisher(
+    z_session_t session,
+    z_keyexpr_t keyexpr,
+    z_shared_memory_provider_t provider,
+    size_t size,
+    const z_state_topic_options_t *options);
+
+/// Overwrite the state
+/// Only one thread may write the state at a time, readers never block the writer
+/// @param pub the state publisher
+/// @param data the new state
+/// @param len the length of data, must not exceed the size the publisher was declared with
+/// @returns 0 in case of success, negative value in case of failure
+ZENOHC_API int8_t z_state_publisher_write(const z_owned_state_publisher_t *pub, const uint8_t *data, size_t len);
+
+/// Returns `false` if `pub` is the gravestone value
+ZENOHC_API bool z_state_publisher_check(const z_owned_state_publisher_t *pub);
+
+/// Undeclare the state publisher, the slot is freed once all subscribers detach from it
+ZENOHC_API int8_t z_undeclare_state_publisher(z_owned_state_publisher_t *pub);
+
+/// Declare state subscriber
+/// @param session zenoh session
+/// @param keyexpr the key expression of the state topic
+/// @param callback optional change notification closure, can be NULL
+/// @param options state topic options, NULL means default options (notify_interval_ms further limits
+///                the notification rate, the bigger of the publisher's and subscriber's intervals is used)
+/// @returns the state subscriber
+ZENOHC_API z_owned_state_subscriber_t z_declare_state_subscriber(
+    z_session_t session,
+    z_keyexpr_t keyexpr,
+    z_owned_closure_state_t *callback,
+    const z_state_topic_options_t *options);
+
+/// Read the latest consistent snapshot of the state
+/// The read is retried internally while the publisher is overwriting the slot, but no more than read_retries
+/// times (see z_state_topic_options_t), so the call never spins forever (e.g. if the publisher crashed leaving the slot half-written).
+/// No locks are taken
+/// @param sub the state subscriber
+/// @param data buffer to copy the state into
+/// @param capacity the size of data
+/// @param len will contain the length of the state
+/// @param version will contain the version of the state, can be NULL
+/// @returns STATE_OK, or the reason why no snapshot is read
+ZENOHC_API z_state_result_t z_state_subscriber_read(
+    const z_owned_state_subscriber_t *sub,
+    uint8_t *data,
+    size_t capacity,
+    size_t *len,
+    uint64_t *version);
+
+/// Returns `false` if `sub` is the gravestone value
+ZENOHC_API bool z_state_subscriber_check(const z_owned_state_subscriber_t *sub);
+
+/// Undeclare the state subscriber, detaching it from the slot
+ZENOHC_API int8_t z_undeclare_state_subscriber(z_owned_state_subscriber_t *sub);
+
+//// TRIPLE BUFFERS ////
+
+// Triple buffer is a frame exchange channel between a writer and readers on the same host
+// (e.g. camera-to-renderer pipelines): the writer never blocks and the reader always gets the latest complete frame.
+// All the frames and the control block with atomic indices are allocated with a single allocation from the
+// writer's provider, so no chunks are allocated or freed per frame. max_readers + 2 frames are allocated, and the
+// control block holds the atomic index of the latest frame and max_readers reader slots. An attaching reader claims
+// a free slot, and the slot atomically records the frame the reader holds, which is the only record of frames in use.
+// Readers hold at most max_readers frames and one more frame is the latest, so at least one frame is neither
+// recorded in a slot nor latest and the writer can always fill it. With one reader this reduces to a classic
+// triple buffer. As the slots are the whole reader state, a crashed reader process is cleaned up by just freeing
+// it's slot: the writer's session does it once it sees the reader's session gone (liveliness loss or transport
+// close). Until then the crashed reader's frame stays pinned, but it still counts against max_readers, so the
+// writer keeps a free frame, it just can't accept a new reader in that slot
+
+// Options for triple buffer writer
+typedef struct z_triple_buffer_options_t
+{
+    // the maximal number of readers attached at once
+    size_t max_readers;
+} z_triple_buffer_options_t;
+
+/// Constructs the default value for z_triple_buffer_options_t
+ZENOHC_API z_triple_buffer_options_t z_triple_buffer_options_default(void);
+
+typedef struct z_owned_triple_buffer_writer_t
+{
+    void *_0;
+} z_owned_triple_buffer_writer_t;
+
+typedef struct z_owned_triple_buffer_reader_t
+{
+    void *_0;
+} z_owned_triple_buffer_reader_t;
+
+/// Declare triple buffer writer
+/// @param session zenoh session
+/// @param keyexpr the key expression readers attach to
+/// @param provider the provider to allocate the frames from
+/// @param frame_size the capacity of each frame
+/// @param options triple buffer options, NULL means default options (one reader)
+/// @returns the writer, or invalid if allocation failed
+ZENOHC_API z_owned_triple_buffer_writer_t z_declare_triple_buffer_writer(
+    z_session_t session,
+    z_keyexpr_t keyexpr,
+    z_shared_memory_provider_t provider,
+    size_t frame_size,
+    const z_triple_buffer_options_t *options);
+
+/// Get the frame to fill (the back buffer)
+/// The frame stays the same until z_triple_buffer_writer_publish is called
+ZENOHC_API uint8_t *z_triple_buffer_writer_frame(const z_owned_triple_buffer_writer_t *writer);
+
+/// Publish the filled frame, making it the latest one
+/// The latest frame index is replaced by the frame's index by a single atomic store, then the writer scans the reader
+/// slots and picks any frame which is neither recorded in a slot nor the latest as the next frame to fill.
+/// Such a frame always exists, so the call never blocks
+/// @param writer the writer
+/// @param len the length of data in the frame
+ZENOHC_API void z_triple_buffer_writer_publish(const z_owned_triple_buffer_writer_t *writer, size_t len);
+
+/// Returns `false` if `writer` is the gravestone value
+ZENOHC_API bool z_triple_buffer_writer_check(const z_owned_triple_buffer_writer_t *writer);
+
+/// Undeclare the writer, the frames are freed once all readers detach
+ZENOHC_API int8_t z_undeclare_triple_buffer_writer(z_owned_triple_buffer_writer_t *writer);
+
+/// Declare triple buffer reader
+/// The reader attaches to the writer's frames upon discovery, so it needs the client for the provider's protocol
+/// @param session zenoh session
+/// @param keyexpr the key expression of the writer
+/// @returns the reader
+ZENOHC_API z_owned_triple_buffer_reader_t z_declare_triple_buffer_reader(z_session_t session, z_keyexpr_t keyexpr);
+
+/// Acquire the latest complete frame
+/// If a newer frame is published, the reader stores the latest frame index into it's reader slot (which releases
+/// the previously acquired frame) and re-checks that the frame is still the latest, retrying otherwise: a frame that
+/// stopped being the latest before the store may already be taken by the writer.
+/// Otherwise the previously acquired frame is returned again
+/// @param reader the reader
+/// @param frame will contain the frame, valid until the next acquire or the reader undeclaration
+/// @param version will contain the frame version (incremented by each publish), can be NULL
+/// @returns false if the writer is not discovered yet, there is no frame published yet,
+///          or all max_readers reader slots are taken (including slots of crashed readers not reclaimed yet)
+ZENOHC_API bool z_triple_buffer_reader_acquire(
+    const z_owned_triple_buffer_reader_t *reader,
+    z_bytes_t *frame,
+    uint64_t *version);
+
+/// Returns `false` if `reader` is the gravestone value
+ZENOHC_API bool z_triple_buffer_reader_check(const z_owned_triple_buffer_reader_t *reader);
+
+/// Undeclare the reader, releasing it's frame and reader slot
+ZENOHC_API int8_t z_undeclare_triple_buffer_reader(z_owned_triple_buffer_reader_t *reader);